@@ -1,7 +1,7 @@
 #ifndef NPRPC_ENDPOINT_
 #define NPRPC_ENDPOINT_
 
-#include <boost/system/errc.hpp>
+#include <boost/system/error_code.hpp>
 #include <boost/beast/core/flat_buffer.hpp>
 #include <boost/asio/ip/address_v4.hpp>
 
@@ -8,6 +8,7 @@
 #include <boost/asio/ip/tcp.hpp>
 #include <boost/asio/strand.hpp>
 #include <boost/core/exchange.hpp>
+#include <algorithm>
 #include <mutex>
 #include <cassert>
 #include <iostream>
@@ -15,6 +16,7 @@
 #include <stdexcept>
 #include <unordered_map>
 #include <mutex>
+#include <shared_mutex>
 #include <condition_variable>
 #include <optional>
 #include <deque>
@@ -26,6 +28,15 @@ namespace nprpc::impl {
 
 extern Config g_cfg;
 
+// Compile-time ceiling for debug logging. Build with
+// -DNPRPC_MAX_DEBUG_LEVEL=0 to strip every log branch and its
+// formatting from the datapath; by default all runtime levels stay
+// available.
+#ifndef NPRPC_MAX_DEBUG_LEVEL
+#define NPRPC_MAX_DEBUG_LEVEL 255
+#endif
+constexpr auto max_debug_level = static_cast<DebugLevel>(NPRPC_MAX_DEBUG_LEVEL);
+
 class RpcImpl;
 class PoaImpl;
 
@@ -99,10 +110,14 @@ class RpcImpl : public Rpc {
 	std::array<std::unique_ptr<PoaImpl>, 10> poas_;
 	std::atomic<poa_idx_t> poa_size_ = 0;
 
-	mutable std::mutex connections_mut_;
-	std::vector<std::shared_ptr<Session>> opened_sessions_;
+	mutable std::shared_mutex connections_mut_;
+	// keyed by EndPoint::hash - the same packed ip4:port word operator== compares
+	std::unordered_map<uint64_t, std::shared_ptr<Session>> opened_sessions_;
 
 	boost::asio::deadline_timer timer1_;
+
+	std::mutex nameserver_cache_mut_;
+	std::unordered_map<std::string, ObjectPtr<Nameserver>> nameserver_cache_;
 public:
 	std::mutex new_activated_objects_mut_;
 	std::vector<ObjectServant*> new_activated_objects_;
@@ -111,7 +126,9 @@ public:
 	uint16_t websocket_port() const noexcept { return g_cfg.websocket_port; }
 
 	void add_connection(std::shared_ptr<Session>&& session) {
-		opened_sessions_.push_back(std::move(session));
+		auto const key = session->remote_endpoint().hash;
+		std::lock_guard<std::shared_mutex> lk(connections_mut_);
+		opened_sessions_[key] = std::move(session);
 	}
 
 	bool has_session(const EndPoint& endpoint) const noexcept;
@@ -184,14 +201,15 @@ public:
 class ObjectGuard {
 	ObjectServant* obj_;
 public:
-	ObjectServant* get() noexcept { 
-		return !obj_->to_delete_.load() ? obj_ : nullptr; 
+	ObjectServant* get() noexcept {
+		return !(obj_->in_use_cnt_.load(std::memory_order_acquire) & ObjectServant::to_delete_bit)
+			? obj_ : nullptr;
 	}
 
 	explicit ObjectGuard(ObjectServant* obj) noexcept
-		: obj_(obj) 
+		: obj_(obj)
 	{
-		++obj->in_use_cnt_;
+		obj->in_use_cnt_.fetch_add(1, std::memory_order_acquire);
 	}
 
 	ObjectGuard(ObjectGuard&& other) noexcept
@@ -200,7 +218,7 @@ public:
 	}
 
 	~ObjectGuard() {
-		if (obj_) --obj_->in_use_cnt_;
+		if (obj_) obj_->in_use_cnt_.fetch_sub(1, std::memory_order_release);
 	}
 
 	ObjectGuard(const ObjectGuard&) = delete;
@@ -371,18 +389,29 @@ public:
 	virtual void deactivate_object(oid_t object_id) override {
 		auto obj = object_map_.get(object_id);
 		if (obj) {
-			obj->to_delete_.store(true);
+			obj->in_use_cnt_.fetch_or(ObjectServant::to_delete_bit, std::memory_order_acq_rel);
 			object_map_.remove(object_id);
 		} else {
 			std::cerr << "deactivate_object: object not found. id = " << object_id << '\n';
 		}
 	}
 
-	static void delete_object(ObjectServant* obj) {
-		if (obj->in_use_cnt_.load(std::memory_order_acquire) == 0) {
+	static void delete_object(ObjectServant* obj, uint32_t delay_ms = 0) {
+		// delete bit set and no guards left
+		if (obj->in_use_cnt_.load(std::memory_order_acquire) == ObjectServant::to_delete_bit) {
 			obj->destroy();
+		} else if (delay_ms == 0) {
+			// a guard is still held: it is usually released within the current
+			// handler batch, so one immediate repost is enough most of the time
+			boost::asio::post(impl::g_orb->ioc(), [obj] { delete_object(obj, 1); });
 		} else {
-			boost::asio::post(impl::g_orb->ioc(), std::bind(&PoaImpl::delete_object, obj));
+			// still held after the repost - back off on a timer instead of
+			// spinning through the executor queue
+			auto timer = std::make_shared<boost::asio::deadline_timer>(impl::g_orb->ioc());
+			timer->expires_from_now(boost::posix_time::milliseconds(delay_ms));
+			timer->async_wait([timer, obj, delay_ms](const boost::system::error_code&) {
+				delete_object(obj, std::min(delay_ms * 2, 100u));
+			});
 		}
 	}
 };
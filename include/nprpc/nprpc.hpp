@@ -134,8 +134,9 @@ class ObjectServant {
 	oid_t object_id_;
 
 	std::atomic_uint32_t ref_cnt_{ 0 };
+	// bit 31 marks an object scheduled for deletion, low bits count active guards
+	static constexpr uint32_t to_delete_bit = 1u << 31;
 	std::atomic_uint32_t in_use_cnt_{ 0 };
-	std::atomic_bool to_delete_{false};
 	std::chrono::system_clock::time_point activation_time_;
 	std::optional<SessionContext> session_ctx_;
 public:
@@ -149,7 +150,7 @@ public:
 	NPRPC_API uint32_t add_ref() noexcept;
 	auto activation_time() const noexcept { return activation_time_; }
 	bool is_unused() const noexcept { return ref_cnt_.load() == 0; }
-	bool is_deleted() const noexcept { return to_delete_.load(); }
+	bool is_deleted() const noexcept { return (in_use_cnt_.load() & to_delete_bit) != 0; }
 	bool validate_session(SessionContext& ctx) const noexcept { 
 		return !session_ctx_.has_value() ||
 			session_ctx_.value() == ctx;
@@ -11,7 +11,7 @@ namespace nprpc::impl {
 void SocketConnection::send_receive(flat_buffer& buffer, uint32_t timeout_ms) {
 	assert(*(uint32_t*)buffer.data().data() == buffer.size() - 4);
 
-	if (g_cfg.debug_level >= DebugLevel::DebugLevel_EveryMessageContent) {
+	if (max_debug_level >= DebugLevel::DebugLevel_EveryMessageContent && g_cfg.debug_level >= DebugLevel::DebugLevel_EveryMessageContent) {
 		dump_message(buffer, false);
 	}
 
@@ -64,7 +64,7 @@ void SocketConnection::send_receive(flat_buffer& buffer, uint32_t timeout_ms) {
 	auto ec = post_work_and_wait();
 	
 	if (!ec) {
-		if (g_cfg.debug_level >= DebugLevel::DebugLevel_EveryMessageContent) {
+		if (max_debug_level >= DebugLevel::DebugLevel_EveryMessageContent && g_cfg.debug_level >= DebugLevel::DebugLevel_EveryMessageContent) {
 			dump_message(buffer, true);
 		}
 		return;
@@ -141,6 +141,9 @@ void SocketConnection::reconnect() {
 		close();
 		throw nprpc::ExceptionCommFailure();
 	}
+
+	socket_.set_option(tcp::no_delay(true), ec);
+	if (ec) fail(ec, "set_option(no_delay)");
 }
 
 void SocketConnection::do_read_size() {
@@ -150,15 +153,14 @@ void SocketConnection::do_read_size() {
 
 	timeout_timer_.expires_from_now(timeout_);
 	socket_.async_read_some(net::mutable_buffer(&rx_size_, 4),
-		std::bind(&SocketConnection::on_read_size, this, std::placeholders::_1, std::placeholders::_2)
+		[this](const boost::system::error_code& ec, size_t len) { on_read_size(ec, len); }
 	);
 }
 
 void SocketConnection::do_read_body() {
 	timeout_timer_.expires_from_now(timeout_);
 	socket_.async_read_some(current_rx_buffer().prepare(rx_size_),
-		std::bind(&SocketConnection::on_read_body, this,
-			std::placeholders::_1, std::placeholders::_2)
+		[this](const boost::system::error_code& ec, size_t len) { on_read_body(ec, len); }
 	);
 }
 
@@ -227,6 +229,8 @@ SocketConnection::SocketConnection(const EndPoint& endpoint, boost::asio::ip::tc
 	boost::system::error_code ec;
 	socket_.connect(tcp::endpoint(net::ip::address_v4(ctx_.remote_endpoint.ip4), ctx_.remote_endpoint.port), ec);
 	if (ec) throw nprpc::Exception(("Could not connect to the socket: " + ec.message()).c_str());
+	socket_.set_option(tcp::no_delay(true), ec);
+	if (ec) fail(ec, "set_option(no_delay)");
 	check_timeout();
 }
 
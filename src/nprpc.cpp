@@ -32,7 +32,7 @@ void RpcImpl::check_unclaimed_objects(boost::system::error_code ec) {
 	}
 
 	timer1_.expires_from_now(boost::posix_time::milliseconds(2500));
-	timer1_.async_wait(boost::bind(&RpcImpl::check_unclaimed_objects, this, std::placeholders::_1));
+	timer1_.async_wait(boost::bind(&RpcImpl::check_unclaimed_objects, this, boost::placeholders::_1));
 }
 
 Config g_cfg;
@@ -57,11 +57,18 @@ Poa* RpcImpl::create_poa(uint32_t objects_max, std::initializer_list<Policy*> po
 NPRPC_API std::shared_ptr<Session> RpcImpl::get_session(const EndPoint& endpoint) {
 	std::shared_ptr<Session> con;
 	{
-		std::lock_guard<std::mutex> lk(connections_mut_);
-		if (auto founded = std::find_if(opened_sessions_.begin(), opened_sessions_.end(),
-			[&endpoint](auto const& ptr) { return ptr->remote_endpoint() == endpoint; });
+		std::shared_lock<std::shared_mutex> lk(connections_mut_);
+		if (auto founded = opened_sessions_.find(endpoint.hash);
 			founded != opened_sessions_.end()) {
-			con = (*founded);
+			con = founded->second;
+		}
+	}
+	if (!con) {
+		std::lock_guard<std::shared_mutex> lk(connections_mut_);
+		// somebody might have opened the session while the lock was released
+		if (auto founded = opened_sessions_.find(endpoint.hash);
+			founded != opened_sessions_.end()) {
+			con = founded->second;
 		} else {
 			if (endpoint.websocket) throw nprpc::ExceptionCommFailure();
 			if (endpoint.is_local()) {
@@ -72,7 +79,7 @@ NPRPC_API std::shared_ptr<Session> RpcImpl::get_session(const EndPoint& endpoint
 					boost::asio::ip::tcp::socket(boost::asio::make_strand(ioc_))
 					);
 			}
-			opened_sessions_.push_back(con);
+			opened_sessions_.emplace(endpoint.hash, con);
 		}
 	}
 	return con;
@@ -97,18 +104,13 @@ NPRPC_API std::optional<ObjectGuard> RpcImpl::get_object(poa_idx_t poa_idx, oid_
 }
 
 bool RpcImpl::has_session(const EndPoint& endpoint) const noexcept {
-	std::lock_guard<std::mutex> lk(connections_mut_);
-	return std::find_if(opened_sessions_.begin(), opened_sessions_.end(),
-		[endpoint](auto const& ptr) { return ptr->remote_endpoint() == endpoint; }) != opened_sessions_.end();
+	std::shared_lock<std::shared_mutex> lk(connections_mut_);
+	return opened_sessions_.find(endpoint.hash) != opened_sessions_.end();
 }
 
 bool RpcImpl::close_session(Session* session) {
-	std::lock_guard<std::mutex> lk(connections_mut_);
-	if (auto founded = std::find_if(opened_sessions_.begin(), opened_sessions_.end(),
-		[session](auto const& ptr) { return ptr->remote_endpoint() == session->remote_endpoint(); });
-		founded != opened_sessions_.end()) {
-		opened_sessions_.erase(founded);
-	} else {
+	std::lock_guard<std::shared_mutex> lk(connections_mut_);
+	if (opened_sessions_.erase(session->remote_endpoint().hash) == 0) {
 		std::cerr << "Error: session was not found\n";
 		return false;
 	}
@@ -116,15 +118,21 @@ bool RpcImpl::close_session(Session* session) {
 }
 
 ObjectPtr<Nameserver> RpcImpl::get_nameserver(std::string_view nameserver_ip) {
-	ObjectPtr<Nameserver> obj(new Nameserver(0));
-	obj->_data().ip4 = boost::asio::ip::address_v4::from_string(nameserver_ip.data()).to_uint();
-	obj->_data().port = 15000;
-	obj->_data().poa_idx = 0;
-	obj->_data().object_id = 0;
-	obj->_data().flags = (Policy_Lifespan::Persistent << static_cast<int>(detail::ObjectFlag::Policy_Lifespan));
-	obj->_data().class_id = INameserver_Servant::_get_class();
-	obj->add_ref();
-	return obj;
+	std::lock_guard<std::mutex> lk(nameserver_cache_mut_);
+	auto& cached = nameserver_cache_[std::string(nameserver_ip)];
+	if (!cached) {
+		ObjectPtr<Nameserver> obj(new Nameserver(0));
+		obj->_data().ip4 = boost::asio::ip::address_v4::from_string(nameserver_ip.data()).to_uint();
+		obj->_data().port = 15000;
+		obj->_data().poa_idx = 0;
+		obj->_data().object_id = 0;
+		obj->_data().flags = (Policy_Lifespan::Persistent << static_cast<int>(detail::ObjectFlag::Policy_Lifespan));
+		obj->_data().class_id = INameserver_Servant::_get_class();
+		obj->add_ref();
+		cached = std::move(obj);
+	}
+	// the copy add_refs, so the cache keeps its own reference
+	return cached;
 }
 
 RpcImpl::RpcImpl(boost::asio::io_context& ioc)
@@ -139,25 +147,35 @@ RpcImpl::RpcImpl(boost::asio::io_context& ioc)
 }
 
 class ReferenceListImpl {
-	std::vector<std::pair<nprpc::detail::ObjectIdLocal, ObjectServant*>> refs_;
+	struct ObjectIdLocalHash {
+		size_t operator()(const nprpc::detail::ObjectIdLocal& oid) const noexcept {
+			return std::hash<uint64_t>{}(oid.object_id) ^ oid.poa_idx;
+		}
+	};
+	struct ObjectIdLocalEqual {
+		bool operator()(const nprpc::detail::ObjectIdLocal& a, const nprpc::detail::ObjectIdLocal& b) const noexcept {
+			return a.poa_idx == b.poa_idx && a.object_id == b.object_id;
+		}
+	};
+	struct Reference {
+		ObjectServant* obj;
+		uint32_t count;
+	};
+	std::unordered_map<nprpc::detail::ObjectIdLocal, Reference, ObjectIdLocalHash, ObjectIdLocalEqual> refs_;
 public:
 	void add_ref(ObjectServant* obj) {
-#if defined(DEBUG) || defined(_DEBUG) 
-		if (auto it = std::find_if(begin(refs_), end(refs_),
-			[obj](auto& pair) { return pair.second == obj; }); it != end(refs_)) {
-			assert(false);
-		}
-#endif
-		refs_.push_back({{obj->poa_index() ,obj->oid(),}, obj});
+		// a client may reference the same object more than once (e.g. two proxies
+		// over one session), so every AddReference counts and is balanced by its
+		// own ReleaseObject
+		auto [it, inserted] = refs_.try_emplace({obj->poa_index(), obj->oid()}, Reference{obj, 1u});
+		if (!inserted) ++it->second.count;
 		obj->add_ref();
 	}
 
 	bool remove_ref(poa_idx_t poa_idx, oid_t oid) {
-		if (auto it = std::find_if(begin(refs_), end(refs_), 
-			[poa_idx, oid](auto& pair) { return pair.first.poa_idx == poa_idx && pair.first.object_id == oid; }); it != end(refs_)) 
-		{
-			auto ptr = (*it).second;
-			refs_.erase(it);
+		if (auto it = refs_.find({poa_idx, oid}); it != refs_.end()) {
+			auto ptr = it->second.obj;
+			if (--it->second.count == 0) refs_.erase(it);
 			ptr->release();
 			return true;
 		}
@@ -166,7 +184,9 @@ public:
 
 	~ReferenceListImpl() {
 		for (auto& ref : refs_) {
-			ref.second->release();
+			for (auto cnt = ref.second.count; cnt != 0; --cnt) {
+				ref.second.obj->release();
+			}
 		}
 	}
 };
@@ -2,6 +2,7 @@
 // This file is a part of npsystem (Distributed Control System) and covered by LICENSING file in the topmost directory
 
 #include <cstdlib>
+#include <cstring>
 #include <cassert>
 #include <iostream>
 #include <thread>
@@ -71,13 +72,9 @@ public:
       return;
     }
 
+    assert(len == size_to_read_);
     rx_buffer_().commit(len);
-    size_to_read_ -= static_cast<uint32_t>(len);
-
-    if (size_to_read_ != 0) {
-      do_read_body();
-      return;
-    }
+    size_to_read_ = 0;
 
     // readed the whole message
 
@@ -86,15 +83,17 @@ public:
     write_queue_.push_front({});
 
     socket_.async_send(rx_buffer_().cdata(),
-      std::bind(&Session_Socket::on_write, shared_from_this(),
-        std::placeholders::_1, std::placeholders::_2)
+      [self = shared_from_this()](const boost::system::error_code& ec, size_t len) {
+        self->on_write(ec, len);
+      }
     );
   }
 
   void do_read_body() {
-    socket_.async_read_some(rx_buffer_().prepare(size_to_read_),
-      std::bind(&Session_Socket::on_read_body, shared_from_this(),
-        std::placeholders::_1, std::placeholders::_2)
+    net::async_read(socket_, rx_buffer_().prepare(size_to_read_),
+      [self = shared_from_this()](const boost::system::error_code& ec, size_t len) {
+        self->on_read_body(ec, len);
+      }
     );
   }
 
@@ -106,20 +105,23 @@ public:
 
     assert(len == 4);
 
-    if (size_to_read_ > max_message_size) return;
-
-    *(uint32_t*)rx_buffer_().data().data() = size_to_read_;
     rx_buffer_().commit(4);
+    std::memcpy(&size_to_read_, rx_buffer_().cdata().data(), 4);
+
+    if (size_to_read_ > max_message_size) {
+      fail(boost::asio::error::no_buffer_space, "size_to_read_ > max_message_size");
+      return;
+    }
 
     do_read_body();
   }
 
   void do_read_size() {
     rx_buffer_().consume(rx_buffer_().size());
-    rx_buffer_().prepare(4);
-    socket_.async_read_some(net::mutable_buffer(&size_to_read_, 4),
-      std::bind(&Session_Socket::on_read_size, shared_from_this(),
-        std::placeholders::_1, std::placeholders::_2)
+    net::async_read(socket_, rx_buffer_().prepare(4),
+      [self = shared_from_this()](const boost::system::error_code& ec, size_t len) {
+        self->on_read_size(ec, len);
+      }
     );
   }
 
@@ -145,14 +147,20 @@ public:
   void on_accept(const boost::system::error_code& ec, tcp::socket socket) {
     if (ec) {
       fail(ec, "accept");
+    } else {
+      boost::system::error_code opt_ec;
+      socket.set_option(tcp::no_delay(true), opt_ec);
+      if (opt_ec) fail(opt_ec, "set_option(no_delay)");
+      std::make_shared<Session_Socket>(std::move(socket))->run();
     }
-    std::make_shared<Session_Socket>(std::move(socket))->run();
     do_accept();
   }
 
   void do_accept() {
     acceptor_.async_accept(net::make_strand(ioc_),
-      boost::beast::bind_front_handler(&Acceptor::on_accept, shared_from_this())
+      [self = shared_from_this()](const boost::system::error_code& ec, tcp::socket socket) {
+        self->on_accept(ec, std::move(socket));
+      }
     );
   }
 
@@ -474,7 +474,7 @@ public:
 	) {
 		assert(*(uint32_t*)buffer.data().data() == buffer.size() - 4);
 
-		if (g_cfg.debug_level >= DebugLevel::DebugLevel_EveryMessageContent) {
+		if (max_debug_level >= DebugLevel::DebugLevel_EveryMessageContent && g_cfg.debug_level >= DebugLevel::DebugLevel_EveryMessageContent) {
 			dump_message(buffer, false);
 		}
 
@@ -527,7 +527,7 @@ public:
 		auto ec = f.get();
 
 		if (!ec) {
-			if (g_cfg.debug_level >= DebugLevel::DebugLevel_EveryMessageContent) {
+			if (max_debug_level >= DebugLevel::DebugLevel_EveryMessageContent && g_cfg.debug_level >= DebugLevel::DebugLevel_EveryMessageContent) {
 				dump_message(buffer, true);
 			}
 		} else {
@@ -1136,16 +1136,24 @@ private:
 // The SSL context is required, and holds certificates
 ssl::context ctx{ssl::context::tlsv12};
 
+// baseline TLS policy for the listener, folded at compile time
+constexpr auto tls_server_options =
+	ssl::context::default_workarounds |
+	ssl::context::no_sslv2 |
+	ssl::context::no_sslv3;
+
 
 void init_web_socket(boost::asio::io_context& ioc) {
 	if (!nprpc::impl::g_cfg.websocket_port) return;
 
 	if (nprpc::impl::g_cfg.use_ssl) {
 		auto read_file_to_string = [](std::string const file) {
-			std::ifstream is(file, std::ios_base::in);
+			std::ifstream is(file, std::ios_base::in | std::ios_base::binary | std::ios_base::ate);
 			if (!is) { throw std::runtime_error("could not open certificate file: \"" + file + "\""); }
-			return std::string(std::istreambuf_iterator<char>(is),
-				std::istreambuf_iterator<char>());
+			std::string str(static_cast<size_t>(is.tellg()), '\0');
+			is.seekg(0);
+			is.read(str.data(), str.size());
+			return str;
 		};
 
 		std::string const cert = read_file_to_string(nprpc::impl::g_cfg.ssl_public_key);
@@ -1158,10 +1166,7 @@ void init_web_socket(boost::asio::io_context& ioc) {
 				return "test";
 			});
 
-		ctx.set_options(
-			boost::asio::ssl::context::default_workarounds |
-			boost::asio::ssl::context::no_sslv2 | 
-			boost::asio::ssl::context::no_sslv3 |
+		ctx.set_options(tls_server_options |
 			(nprpc::impl::g_cfg.ssl_dh_params.size() > 0 ? boost::asio::ssl::context::single_dh_use : 0)
 		);
 
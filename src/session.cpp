@@ -38,17 +38,19 @@ void Session::handle_request() {
 		return false;
 	};
 
-	if (g_cfg.debug_level >= DebugLevel::DebugLevel_EveryMessageContent) {
+	const auto debug_level = g_cfg.debug_level;
+
+	if (max_debug_level >= DebugLevel::DebugLevel_EveryMessageContent && debug_level >= DebugLevel::DebugLevel_EveryMessageContent) [[unlikely]] {
 		std::cout << "received a message:\n";
 		dump_message(rx_buffer_(), true);
 	}
 
 	auto cb = rx_buffer_().cdata();
 	switch (static_cast<const impl::Header*>(cb.data())->msg_id) {
-	case MessageId::FunctionCall: {
+	[[likely]] case MessageId::FunctionCall: {
 		impl::flat::CallHeader_Direct ch(rx_buffer_(), sizeof(impl::Header));
 		
-		if (g_cfg.debug_level >= DebugLevel::DebugLevel_EveryCall) {
+		if (max_debug_level >= DebugLevel::DebugLevel_EveryCall && debug_level >= DebugLevel::DebugLevel_EveryCall) [[unlikely]] {
 			std::cout << "FunctionCall. " << "interface_idx: " << (uint32_t)ch.interface_idx() << ", fn_idx: " << (uint32_t)ch.function_idx() 
 				<< ", poa_idx: " << ch.poa_idx() << ", oid: " << ch.object_id() << std::endl;
 		}
@@ -72,7 +74,7 @@ void Session::handle_request() {
 		detail::flat::ObjectIdLocal_Direct msg(rx_buffer_(), sizeof(impl::Header));
 		detail::ObjectIdLocal oid{ msg.poa_idx(), msg.object_id() };
 		
-		if (g_cfg.debug_level >= DebugLevel::DebugLevel_EveryCall) {
+		if (max_debug_level >= DebugLevel::DebugLevel_EveryCall && debug_level >= DebugLevel::DebugLevel_EveryCall) [[unlikely]] {
 			std::cout << "AddReference. " << "poa_idx: " << oid.poa_idx << ", oid: " << oid.object_id << std::endl;
 		}
 		
@@ -86,12 +88,12 @@ void Session::handle_request() {
 		}
 		
 		if (success) {
-			if (g_cfg.debug_level >= DebugLevel::DebugLevel_EveryCall) {
+			if (max_debug_level >= DebugLevel::DebugLevel_EveryCall && debug_level >= DebugLevel::DebugLevel_EveryCall) [[unlikely]] {
 				std::cout << "Refference added." << std::endl;
 			}
 			make_simple_answer(rx_buffer_(), nprpc::impl::MessageId::Success);
 		} else {
-			if (g_cfg.debug_level >= DebugLevel::DebugLevel_EveryCall) {
+			if (max_debug_level >= DebugLevel::DebugLevel_EveryCall && debug_level >= DebugLevel::DebugLevel_EveryCall) [[unlikely]] {
 				std::cout << "Object not found." << std::endl;
 			}
 			make_simple_answer(rx_buffer_(), nprpc::impl::MessageId::Error_ObjectNotExist);
@@ -103,7 +105,7 @@ void Session::handle_request() {
 		detail::flat::ObjectIdLocal_Direct msg(rx_buffer_(), sizeof(impl::Header));
 		detail::ObjectIdLocal oid{ msg.poa_idx(), msg.object_id() };
 
-		if (g_cfg.debug_level >= DebugLevel::DebugLevel_EveryCall) {
+		if (max_debug_level >= DebugLevel::DebugLevel_EveryCall && debug_level >= DebugLevel::DebugLevel_EveryCall) [[unlikely]] {
 			std::cout << "ReleaseObject. " << "poa_idx: " << oid.poa_idx << ", oid: " << oid.object_id << std::endl;
 		}
 
@@ -115,12 +117,12 @@ void Session::handle_request() {
 
 		break;
 	}
-	default:
+	[[unlikely]] default:
 		make_simple_answer(rx_buffer_(), nprpc::impl::MessageId::Error_UnknownMessageId);
 		break;
 	}
 
-	if (g_cfg.debug_level >= DebugLevel::DebugLevel_EveryMessageContent) {
+	if (max_debug_level >= DebugLevel::DebugLevel_EveryMessageContent && debug_level >= DebugLevel::DebugLevel_EveryMessageContent) [[unlikely]] {
 		std::cout << "sending reply:\n";
 		dump_message(rx_buffer_(), true);
 	}
@@ -3,7 +3,13 @@
 
 namespace nprpc {
 
+// initial-exec keeps the per-dispatch accesses a single fs-relative load
+// instead of a __tls_get_addr call through the PLT
+#if defined(__GNUC__) && !defined(_WIN32)
+static thread_local const SessionContext* ctx __attribute__((tls_model("initial-exec")));
+#else
 static thread_local const SessionContext* ctx;
+#endif
 
 NPRPC_API const SessionContext& get_context() {
 	return (*ctx);